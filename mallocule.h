@@ -16,10 +16,14 @@ typedef struct molecule_t {
     struct molecule_t* prev; /* A pointer to the previous block in the heap. */
 } molecule_t;
 
+/* Flags for mol_reserve. */
+#define MOL_RESERVE_PREFAULT 0x1 /* Touch every page of the reserved region up front. */
+
 /* Public API function declarations. */
 void* mol_alloc(size_t size);
 void* mol_realloc(void* ptr, size_t size);
 void mol_free(void* ptr);
+int mol_reserve(size_t size, int flags);
 
 /*
  * Debugging macro to print the heap state.
@@ -34,6 +38,7 @@ void mol_print_heap();
 
 #ifdef MALLOCULE_IMPL
 
+#include <stdint.h>
 #include <unistd.h>
 #include <pthread.h>
 
@@ -53,6 +58,8 @@ static pthread_mutex_t heap_mutex = PTHREAD_MUTEX_INITIALIZER;
 static void* mol_alloc_unlocked(size_t size);
 static void* mol_realloc_unlocked(void* ptr, size_t size);
 static void mol_free_unlocked(void* ptr);
+static int mol_reserve_unlocked(size_t size, int flags);
+static void prefault_block(molecule_t* block);
 static void split_block(molecule_t* block, size_t new_size);
 static molecule_t* merge_free_blocks(molecule_t* block);
 
@@ -89,6 +96,23 @@ void mol_free(void* ptr) {
     pthread_mutex_unlock(&heap_mutex);
 }
 
+/*
+ * Ensures the heap ends with a free block of at least `size` payload bytes,
+ * so early allocations are carved from it instead of growing the heap.
+ * Each allocation also takes ALIGN(sizeof(molecule_t)) bytes of that block
+ * for its header, so `size` must account for those to avoid calling sbrk.
+ * With MOL_RESERVE_PREFAULT, the reserved pages are also touched so the
+ * first allocations don't pay for page faults.
+ * Returns 0 on success and -1 if the heap could not be extended, `size`
+ * is too large, or `flags` contains unknown bits.
+ */
+int mol_reserve(size_t size, int flags) {
+    pthread_mutex_lock(&heap_mutex);
+    int result = mol_reserve_unlocked(size, flags);
+    pthread_mutex_unlock(&heap_mutex);
+    return result;
+}
+
 void* mol_alloc_unlocked(size_t size) {
     if (size == 0) return NULL;
     size_t requested_size = ALIGN(size);
@@ -169,6 +193,74 @@ void* mol_realloc_unlocked(void* ptr, size_t size) {
     return new_ptr;
 }
 
+int mol_reserve_unlocked(size_t size, int flags) {
+    if (flags & ~MOL_RESERVE_PREFAULT) return -1;
+    if (size == 0) return 0;
+    /*
+     * Reject sizes that would overflow ALIGN or reach sbrk as a negative
+     * increment, leaving room for rounding plus a guard and a block header.
+     */
+    if (size > (size_t)INTPTR_MAX - 2 * ALIGN(sizeof(molecule_t)) - (ALIGNMENT - 1)) return -1;
+    size_t requested_size = ALIGN(size);
+
+    int tail_at_break = tail != NULL && sbrk(0) == (void*)((char*)(tail + 1) + tail->size);
+
+    if (tail != NULL && tail->is_free && tail->size >= requested_size) {
+        /* The free block at the end of the heap is already large enough. */
+    } else if (tail != NULL && tail->is_free && tail_at_break) {
+        /* The free tail block ends at the program break, so grow it in place. */
+        size_t missing_size = requested_size - tail->size;
+        if (sbrk(missing_size) == (void*)-1) return -1;
+        tail->size += missing_size;
+    } else {
+        /*
+         * Otherwise, append a new free block covering the whole reservation.
+         * If something else moved the break since the tail was created, the
+         * new block is not contiguous with it, so a used, empty guard block
+         * is placed in front to keep the two from ever being merged.
+         */
+        size_t guard_size = (tail != NULL && !tail_at_break) ? ALIGN(sizeof(molecule_t)) : 0;
+        size_t total_block_size = guard_size + ALIGN(sizeof(molecule_t)) + requested_size;
+        char* region = sbrk(total_block_size);
+        if (region == (void*)-1) return -1;
+
+        if (guard_size > 0) {
+            molecule_t* guard = (molecule_t*)region;
+            guard->is_free = 0;
+            guard->size = 0;
+            guard->next = NULL;
+            guard->prev = tail;
+            tail->next = guard;
+            tail = guard;
+        }
+
+        molecule_t* new_block = (molecule_t*)(region + guard_size);
+        new_block->is_free = 1;
+        new_block->size = requested_size;
+        new_block->next = NULL;
+        new_block->prev = tail;
+
+        if (head == NULL) head = new_block;
+        else tail->next = new_block;
+        tail = new_block;
+    }
+
+    if (flags & MOL_RESERVE_PREFAULT) prefault_block(tail);
+    return 0;
+}
+
+/* Writes to every page of a free block's payload to fault it in ahead of time. */
+static void prefault_block(molecule_t* block) {
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (page_size <= 0) page_size = 4096;
+
+    volatile char* payload = (volatile char*)(block + 1);
+    for (size_t offset = 0; offset < block->size; offset += (size_t)page_size) {
+        payload[offset] = 0;
+    }
+    payload[block->size - 1] = 0;
+}
+
 /* Splits a block into a used part and a new free part if it's too large. */
 static void split_block(molecule_t* block, size_t new_size) {
     /* A new block must be large enough to hold its header and at least 1 byte. */
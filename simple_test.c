@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <assert.h>
+#include <errno.h>
+#include <unistd.h>
 
 #define MALLOCULE_IMPL
 //#define MALLOCULE_DEBUG
@@ -250,6 +252,116 @@ void test_stress() {
     printf("✅ Rapid churn test passed.\n");
 }
 
+/* Counts free blocks that directly follow another free block in the list. */
+static int count_adjacent_free_blocks() {
+    int count = 0;
+    for (molecule_t* curr = head; curr != NULL && curr->next != NULL; curr = curr->next) {
+        if (curr->is_free && curr->next->is_free) count++;
+    }
+    return count;
+}
+
+/*
+ * Verifies every path of mol_reserve: appending a new free block after a used
+ * tail, growing a free tail in place, reusing an existing free tail, and
+ * guarding against a break moved by someone else. Also checks that
+ * allocations fitting into the reserved region don't grow the heap.
+ */
+void test_reserve() {
+    printf("\n🚀 Running Reserve Test\n");
+    DEBUG_PRINT_HEAP();
+
+    size_t header_size = ALIGN(sizeof(molecule_t));
+
+    /* Invalid and empty reservations must leave the heap untouched. */
+    void* heap_end = sbrk(0);
+    assert(mol_reserve(0, 0) == 0);
+    assert(mol_reserve(SIZE_MAX, 0) == -1);
+    assert(mol_reserve((size_t)INTPTR_MAX + 1, 0) == -1);
+    assert(mol_reserve(4096, ~MOL_RESERVE_PREFAULT) == -1);
+    assert(mol_reserve(4096, 0x2) == -1);
+    assert(sbrk(0) == heap_end);
+    printf("✅ Empty and oversized reservations rejected.\n");
+
+    /* Step 1: Make the tail a used block, then reserve a new free block after it. */
+    void* filler = NULL;
+    if (tail != NULL && tail->is_free) filler = mol_alloc(tail->size);
+    assert(tail == NULL || !tail->is_free);
+    heap_end = sbrk(0);
+    int tail_at_break = tail == NULL || (void*)((char*)(tail + 1) + tail->size) == heap_end;
+
+    assert(mol_reserve(4000, MOL_RESERVE_PREFAULT) == 0);
+    size_t expected_growth = (tail_at_break ? 0 : header_size) + header_size + ALIGN(4000);
+    assert((char*)sbrk(0) == (char*)heap_end + expected_growth);
+    assert(tail->is_free && tail->size >= ALIGN(4000));
+    assert(count_adjacent_free_blocks() == 0);
+    printf("🔍 Step 1: Reserved 4000 bytes after a used tail block.\n");
+    DEBUG_PRINT_HEAP();
+
+    /* Step 2: Free a tail block and reserve more than its size; it must grow in place. */
+    void* p1 = mol_alloc(tail->size);
+    assert(p1 != NULL && !tail->is_free);
+    mol_free(p1);
+    assert(tail->is_free);
+    molecule_t* reserved = tail;
+    heap_end = sbrk(0);
+
+    assert(mol_reserve(8192, 0) == 0);
+    assert((char*)sbrk(0) == (char*)heap_end + (ALIGN(8192) - ALIGN(4000)));
+    assert(tail == reserved && tail->is_free && tail->size == ALIGN(8192));
+    assert(count_adjacent_free_blocks() == 0);
+    printf("🔍 Step 2: Grew the free tail block in place to 8192 bytes.\n");
+    DEBUG_PRINT_HEAP();
+
+    /* Step 3: Allocations that fit into the reservation (headers included) don't move the break. */
+    heap_end = sbrk(0);
+    void* pointers[32];
+    for (int i = 0; i < 32; i++) {
+        pointers[i] = mol_alloc(128);
+        assert(pointers[i] != NULL);
+        memset(pointers[i], i, 128);
+    }
+    assert(sbrk(0) == heap_end);
+    for (int i = 0; i < 32; i++) {
+        mol_free(pointers[i]);
+    }
+
+    /* Reserving again within the existing free space must not grow the heap. */
+    assert(mol_reserve(2048, 0) == 0);
+    assert(sbrk(0) == heap_end);
+    printf("🔍 Step 3: Allocated 32 blocks from the reserved region.\n");
+    DEBUG_PRINT_HEAP();
+
+    /* Step 4: Move the break behind the allocator's back; the free tail must not be merged across it. */
+    void* foreign = sbrk(4096);
+    assert(foreign != (void*)-1);
+
+    /*
+     * With the tail away from the break, a reservation also needs a guard header.
+     * The largest size that passes the bound must still reach sbrk with a
+     * positive increment (which fails with ENOMEM), while one byte more must
+     * be rejected before sbrk is ever called (errno untouched).
+     */
+    size_t max_size = (size_t)INTPTR_MAX - 2 * header_size - (ALIGNMENT - 1);
+    assert(2 * header_size + ALIGN(max_size) <= (size_t)INTPTR_MAX);
+    heap_end = sbrk(0);
+    errno = 0;
+    assert(mol_reserve(max_size + 1, 0) == -1);
+    assert(errno == 0);
+    assert(mol_reserve(max_size, 0) == -1);
+    assert(errno == ENOMEM);
+    assert(sbrk(0) == heap_end);
+    assert(mol_reserve(ALIGN(8192) + 1024, 0) == 0);
+    assert(count_adjacent_free_blocks() == 0);
+    assert(tail->is_free && tail->size >= ALIGN(8192) + 1024);
+    assert(!tail->prev->is_free && tail->prev->size == 0);
+    assert(reserved->size == ALIGN(8192));
+    printf("🔍 Step 4: Guarded a new reservation from a foreign heap region.\n");
+    DEBUG_PRINT_HEAP();
+
+    mol_free(filler);
+    printf("✅ Test Passed: All reservation paths behave correctly!\n");
+}
 
 int main() {
     test_basic();
@@ -260,5 +372,6 @@ int main() {
     test_merging();
     test_realloc();
     test_stress();
+    test_reserve();
     return 0;
 }
@@ -0,0 +1,88 @@
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define MALLOCULE_IMPL
+#include "mallocule.h"
+
+/* Benchmark Configuration */
+#define NUM_ALLOCS 2000
+#define ALLOC_SIZE 4096
+/* Enough room for every allocation plus its block header. */
+#define RESERVE_SIZE (NUM_ALLOCS * (ALIGN(sizeof(molecule_t)) + ALIGN(ALLOC_SIZE)))
+
+typedef enum {
+    STARTUP_COLD,
+    STARTUP_RESERVE,
+    STARTUP_RESERVE_PREFAULT,
+    STARTUP_MODES_COUNT
+} startup_mode_t;
+
+static const char* mode_names[STARTUP_MODES_COUNT] = {
+    "cold heap",
+    "mol_reserve",
+    "mol_reserve + prefault",
+};
+
+static double elapsed_ms(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+/*
+ * Measures the first NUM_ALLOCS allocations (each written to once, like a
+ * real first request would) after preparing the heap according to `mode`.
+ * Runs in a freshly forked process so every mode starts from an untouched heap.
+ */
+static void run_mode(startup_mode_t mode) {
+    static void* pointers[NUM_ALLOCS];
+    struct timespec start, warm, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (mode != STARTUP_COLD) {
+        int flags = (mode == STARTUP_RESERVE_PREFAULT) ? MOL_RESERVE_PREFAULT : 0;
+        if (mol_reserve(RESERVE_SIZE, flags) != 0) {
+            fprintf(stderr, "ERROR: Reservation of %zu bytes failed\n", (size_t)RESERVE_SIZE);
+            _exit(1);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &warm);
+
+    for (size_t i = 0; i < NUM_ALLOCS; ++i) {
+        pointers[i] = mol_alloc(ALLOC_SIZE);
+        if (pointers[i] == NULL) {
+            fprintf(stderr, "ERROR: Allocation %zu failed\n", i);
+            _exit(1);
+        }
+        memset(pointers[i], 0xAB, ALLOC_SIZE);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    printf("%-24s warm-up: %8.3f ms | first %d allocs: %8.3f ms\n",
+           mode_names[mode], elapsed_ms(start, warm), NUM_ALLOCS, elapsed_ms(warm, end));
+    fflush(stdout);
+}
+
+int main() {
+    printf("\n🚀 Measuring startup cost of %d allocations of %d bytes...\n\n", NUM_ALLOCS, ALLOC_SIZE);
+    fflush(stdout);
+
+    for (int mode = 0; mode < STARTUP_MODES_COUNT; ++mode) {
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("ERROR: Could not fork");
+            return 1;
+        }
+        if (pid == 0) {
+            run_mode(mode);
+            _exit(0);
+        }
+
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) return 1;
+    }
+
+    printf("\n✅ Benchmark completed.\n");
+    return 0;
+}